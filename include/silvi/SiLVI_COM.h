@@ -1,7 +1,7 @@
 /******************************************************************
 * FILE:            SiLVI_COM.h
-* VERSION:         3.0.0.0
-* DATE:            07.03.2024
+* VERSION:         3.9.0.0
+* DATE:            18.10.2026
 * DESCRIPTION:     Interface Description File
 * COPYRIGHT:       (C) 2024 VDA SiLVI Workgroup
 *
@@ -36,9 +36,13 @@ GENERAL NOTES:
    It is not allowed to set any of them to NULL or leave them unimplemented. However, it is allowed to implement
    functions as empty functions returning only a return value.
    The function table for a particular bus type may be NULL if the bus type is not supported by the driver.
+   Extensions are appended at the end of SiLVI_COM_driverFunctionTable_V3 and increase the minor version.
+   Clients must check minorVersion before they access an extension - members beyond the minor version
+   reported by the driver do not exist in the driver's function table.
 
-6) For the standardized protocols (CAN, LIN, FLEXRAY, ETHERNET) the API must be used with the serialization schemas
-   shipped with this header file. Custom network protocols can use different serialization schemas that have to be
+6) For the standardized protocols (CAN, LIN, FLEXRAY, ETHERNET, CAN XL) the API must be used with the serialization schemas
+   shipped with this header file. The file identifiers of those schemas are provided as defines in the header of the
+   respective bus type, e.g. SiLVI_COM_CAN_FILE_IDENTIFIER. Custom network protocols can use different serialization schemas that have to be
    aligned between the driver implementation and the client. Whatever serialization schema is used, the data must be
    representable as a raw byte stream: uint8_t* for data and a uint64_t for length.
    The function types to handle such data are SiLVI_COM_txFrame_p(), SiLVI_COM_rxFrame_p() and SiLVI_COM_rxCallbackFunction().
@@ -115,6 +119,42 @@ GENERAL NOTES:
 *           Enumeration SiLVI_Ethernet_Speed
 *           Removed MIME type and key-value parts of the description of SiLVI_initialize_p
 *           Removed configuration parts of the description of SiLVI_getInfo_p
+*
+* 3.0.1.0	Recommended syntax of logical interface names with bus type prefixes, see SiLVI_COM_Generic.h
+*           Clarified that handles are local to a driver, e.g. for drivers forwarding to other drivers, and that
+*           the simulation time of all handles refers to one time base
+*
+* 3.1.0.0	CAN XL bus type: SiLVI_COM_driverFunctionTable_CANXL_V3 appended to the function table
+*
+* 3.1.0.1	Order and reproducibility of received frames, see SiLVI_COM_Generic.h
+*
+* 3.1.1.0	Defines for the FlatBuffers file identifiers of the bus types, e.g. SiLVI_COM_CAN_FILE_IDENTIFIER
+*
+* 3.2.0.0	Auto initialization of multiple interfaces in one call: auto_initializeMany appended to the function table
+*
+* 3.3.0.0	Delivery of RX callbacks via client executors or on selected CPUs:
+*           registerRxExecutor and setRxAffinity appended to the function table
+*
+* 3.4.0.0	Timer callbacks at a virtual time: registerTimerCallback and cancelTimerCallback appended to the
+*           function table
+*
+* 3.5.0.0	Merging of FlexRay frames received on both channels: setFlexRayChannelMerging appended to the function table
+*
+* 3.6.0.0	Shared simulation clock: getSimulationClock appended to the function table, see SiLVI_COM_Clock.h
+*
+* 3.6.0.1	Alignment and lifetime of buffers passed to the client, see SiLVI_COM_Generic.h
+*
+* 3.7.0.0	Egress model of Ethernet interfaces: reconfigureEthernetEgress appended to the function table
+*
+* 3.7.0.1	Buffers passed to the driver may be preassembled templates, see SiLVI_COM_Generic.h
+*
+* 3.8.0.0	Cyclic transmission by the driver: registerCyclicTx, updateCyclicPayload and unregisterCyclicTx
+*           appended to the function table
+*
+* 3.9.0.0	Payloads of received CAN, CAN XL, LIN and FlexRay frames are padded with zero bytes to a multiple of 8 bytes,
+*           see SiLVI_COM_Generic.h. Buffers passed to RX callback functions are aligned to 8 bytes and frames are
+*           received in a reproducible order, see SiLVI_COM_Generic.h.
+*           No new members, the minor version indicates these guarantees to clients.
 */
 
 #pragma once
@@ -128,6 +168,8 @@ GENERAL NOTES:
 #include "silvi/com/SiLVI_COM_FlexRay.h"
 #include "silvi/com/SiLVI_COM_Ethernet.h"
 #include "silvi/com/SiLVI_COM_CustomBus.h"
+#include "silvi/com/SiLVI_COM_CANXL.h"
+#include "silvi/com/SiLVI_COM_Clock.h"
 
 //SiLVI COM ABI Version 3
 typedef struct SiLVI_COM_driverFunctionTable_V3
@@ -166,6 +208,38 @@ typedef struct SiLVI_COM_driverFunctionTable_V3
 	SiLVI_COM_driverFunctionTable_CustomBus_V3 custom_bus;
 
 	//extensions have to be added at the end
+
+	//ABI minor version 1: function table for CAN XL
+	SiLVI_COM_driverFunctionTable_CANXL_V3 canxl;
+
+	//ABI minor version 2: auto initialization of multiple interfaces
+	SiLVI_COM_auto_initialize_many_p auto_initializeMany;
+
+	//ABI minor version 3: delivery of RX callbacks
+	SiLVI_COM_registerRxExecutor_p registerRxExecutor;
+	SiLVI_COM_setRxAffinity_p setRxAffinity;
+
+	//ABI minor version 4: timers
+	SiLVI_COM_registerTimerCallback_p registerTimerCallback;
+	SiLVI_COM_cancelTimerCallback_p cancelTimerCallback;
+
+	//ABI minor version 5: FlexRay channel merging
+	//(extensions of a bus type are added here because extending its function table would move all members behind it)
+	SiLVI_COM_setChannelMerging_flexray_p setFlexRayChannelMerging;
+
+	//ABI minor version 6: shared simulation clock
+	SiLVI_COM_getSimulationClock_p getSimulationClock;
+
+	//ABI minor version 7: Ethernet egress configuration
+	SiLVI_COM_reconfigure_ethernet_egress_p reconfigureEthernetEgress;
+
+	//ABI minor version 8: cyclic transmission
+	SiLVI_COM_registerCyclicTx_p registerCyclicTx;
+	SiLVI_COM_updateCyclicPayload_p updateCyclicPayload;
+	SiLVI_COM_unregisterCyclicTx_p unregisterCyclicTx;
+
+	//ABI minor version 9: no new members, payloads of received frames are padded, received buffers are aligned to
+	//8 bytes and frames are received in a reproducible order (see SiLVI_COM_Generic.h)
 }
 SiLVI_COM_driverFunctionTable_V3;
 
@@ -0,0 +1,189 @@
+/******************************************************************
+* FILE:            SiLVI_SYNC.h
+* VERSION:         3.0.0.0
+* DATE:            18.10.2026
+* DESCRIPTION:     Interface Description File
+* COPYRIGHT:       (C) 2024 VDA SiLVI Workgroup
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+******************************************************************/
+
+/*
+SiLVI Synchronization API and ABI description
+
+This is the API/ABI for stepping of and synchronizing with virtual buses which was announced when
+registerSyncPoint, continueSimulation and registerBusEvent were removed from the communication API (see version
+2.0.0.0 in SiLVI_COM.h). Frame communication still happens via the communication API only.
+
+GENERAL NOTES:
+
+1) The mandatory SiLVI version is 3.0.0 or higher
+
+2) The following API allows to be called from multiple threads. So implementations of SiLVI drivers are generally expected
+   to be thread-safe.
+
+3) The following API makes no statements about reentrant functions. None of the functions is expected to be reentrant.
+   It is generally not allowed to call any of the functions e.g. in a UNIX signal handler or in another context expecting
+   reentrant functions.
+
+4) The following API is a pure C API and hence the caller does not expect (and likely cannot handle) any C++ exceptions
+   So a possible C++ implementation must not throw exceptions and they must catch all exceptions internally before returning to
+   the caller.
+
+5) This header must be compilable by all modern C and C++ compilers.
+
+6) The API/ABI of the driver must be an instance of the function table SiLVI_SYNC_driverFunctionTable_V3 defined below.
+   It has to be exported as DLL/SO symbol "silvi_sync_abi_3" where the last number is the major version number of the ABI.
+   The same number must be assigned to the first uint16_t member of the function table SiLVI_SYNC_driverFunctionTable_V3.
+   All function pointers in the function table must be valid and match the expected function signatures.
+   It is not allowed to set any of them to NULL or leave them unimplemented. However, it is allowed to implement
+   functions as empty functions returning only a return value.
+
+7) The API below does not have any operating system or hardware architecture dependencies.
+   It is expected to work on all major operating systems on both, 32 bit and 64 bit architectures.
+
+8) The versioning schema of this header file is the same as the one of SiLVI_COM.h.
+
+9) Time synchronization is conservative: a participant (typically one model) only advances its virtual time up to
+   the time granted by the driver and the driver never grants a time that would allow a participant to miss a frame.
+   Each participant declares a lookahead: the minimum virtual time between the current time of the participant
+   and the earliest frame the participant can send to a virtual bus.
+
+   A participant sends its frames via SiLVI_COM handles bound to it (see SiLVI_SYNC_bindHandle_p). The driver sets
+   the send request time of every frame passed to SiLVI_COM_txFrame_p for a bound handle to the current time of the
+   participant plus its lookahead, the send_request time stamp in the buffer is ignored. So the lookahead is a
+   property of the frames on the bus and not only a promise of the participant.
+
+   The earliest time at which a participant P can send a frame is
+     - requested time of P plus lookahead of P while P waits in SiLVI_SYNC_requestTimeAdvance_p,
+     - current time of P plus lookahead of P otherwise.
+   The driver grants the requested time of a waiting participant once it is not larger than the earliest time of
+   every other participant. The reception time stamp of a frame is always larger than its send request time, because
+   the transmission takes virtual time, so no frame received up to the granted time can be sent afterwards.
+   Because the rule uses the requested times of waiting participants, the participant with the smallest requested
+   time can always be granted once all participants wait - also with a lookahead of 0. A lookahead of 0 forces the
+   participants into lock step though: a participant can only run in parallel with others up to the sum of their
+   current time and lookahead.
+   The driver may leave out participants whose bound handles cannot reach the virtual buses of the bound handles of
+   the waiting participant, neither directly nor via gateways. Participants on independent parts of the network can
+   therefore run in parallel without waiting for a global simulation step.
+   A driver may implement the coordination locally for all participants in the same process or delegate it to
+   the bus simulation.
+
+   The lookahead is typically derived from the bus latency, e.g. from the duration of the shortest frame a model
+   can send on its buses. The shortest classical CAN data frame takes 44 bit times plus 3 bit times intermission,
+   so a model that only sends on a CAN bus with 500 kbit/s can declare a lookahead of 47 * 2000 ns = 94000 ns.
+
+   All times are integer numbers of nanoseconds of virtual time, the same as in SiLVI_COM_getSimulationTime_p.
+
+* Version history:
+* MAJOR_ABI.MINOR_ABI.API.COMMENT version
+* 3.0.0.0	Initial version of the synchronization interface
+*/
+
+#pragma once
+
+#include "silvi/core/SiLVI_BaseDefs.h"
+#include "silvi/core/SiLVI_Status.h"
+#include "silvi/core/SiLVI_Logging.h"
+
+/*
+ * @brief Registers a participant of the time synchronization
+ * The virtual time of a new participant starts at the largest time granted to the other participants minus the
+ * lookahead of the new participant, but not before 0. So frames of the new participant can't be received in the
+ * past of participants which already hold grants.
+ * @param [out] points to a participant handle to be returned
+ * @param [in] name of the participant, e.g. the name of the model, used for logging and diagnostics only
+ * @param [in] lookahead of the participant in ns
+ * @param [out] pointer to a variable where the start time of the participant in ns is to be stored
+ * @return status indicating success or failure of the operation
+ */
+typedef SiLVI_status(*SiLVI_SYNC_registerParticipant_p)(int32_t*, const char*, uint64_t, uint64_t*);
+
+/*
+ * @brief Unregisters a participant
+ * The participant does not restrict the time grants of other participants anymore.
+ * The handle is considered as invalid after this function call.
+ * @param [in] handle returned by the register function
+ * @return status indicating success or failure of the operation
+ */
+typedef SiLVI_status(*SiLVI_SYNC_unregisterParticipant_p)(int32_t);
+
+/*
+ * @brief Changes the lookahead of a participant
+ * An increased lookahead takes effect immediately. A reduced lookahead must not break the promise given by the
+ * previous one, so it only takes effect once the participant has reached the time promised before.
+ * @param [in] handle returned by the register function
+ * @param [in] new lookahead in ns
+ * @return status indicating success or failure of the operation
+ */
+typedef SiLVI_status(*SiLVI_SYNC_setLookahead_p)(int32_t, uint64_t);
+
+/*
+ * @brief Binds a handle of the communication interface to a participant
+ * The handle must have been returned by an initialize function of the SiLVI_COM function table of the same driver
+ * library. Frames sent via the handle get their send request time from the participant (see note 9) and frames
+ * received via the handle are delivered according to the time granted to the participant. A handle can be bound to
+ * one participant only, frames of handles not bound to any participant are not synchronized.
+ * Cyclic frames of a bound handle (see SiLVI_COM_registerCyclicTx_p) are sent at their own times, but not before the
+ * current time of the participant plus its lookahead at the time of registration.
+ * @param [in] handle returned by the register function
+ * @param [in] handle returned by an initialize function of the communication interface
+ * @return status indicating success or failure of the operation
+ *         SiLVI_ERROR_INVALID_HANDLE if the handle of the communication interface is unknown or already bound
+ */
+typedef SiLVI_status(*SiLVI_SYNC_bindHandle_p)(int32_t, int32_t);
+
+/*
+ * @brief Requests to advance the virtual time of a participant
+ * The call blocks until the driver can grant the requested time according to the rule in note 9. The granted time
+ * becomes the new current time of the participant. If the requested time is not larger than the current time of the
+ * participant the call returns immediately and the current time is granted again.
+ * Before the call returns, all frames of the bound handles with a reception time stamp up to the granted time have
+ * been passed to their RX callback functions (or are available via SiLVI_COM_rxFrame_p) and all timer callbacks of
+ * the bound handles up to the granted time have been called, so the participant can process them.
+ * This function must not be called from within a SiLVI_COM_rxCallbackFunction_p.
+ * @param [in] handle returned by the register function
+ * @param [in] requested time in ns, e.g. the end of the next step of the model
+ * @param [out] pointer to a variable where the granted time is to be stored
+ * @return status indicating success or failure of the operation
+ *         Shall be SiLVI_ERROR_SIMULATION_NOT_RUNNING if the bus simulation is not running
+ */
+typedef SiLVI_status(*SiLVI_SYNC_requestTimeAdvance_p)(int32_t, uint64_t, uint64_t*);
+
+//SiLVI SYNC ABI Version 3
+typedef struct SiLVI_SYNC_driverFunctionTable_V3
+{
+	//version information
+	uint16_t majorVersion;
+	uint16_t minorVersion;
+
+	//padding 32 bit word to avoid padding bytes inserted by the compiler
+	uint32_t padding;
+
+	//logging
+	SiLVI_logCallbackFunction_p defaultLogFunction;
+	SiLVI_registerLogCallbackFunction_p registerLoggerCallback;
+
+	//vendor error description
+	SiLVI_getVendorErrorDescription_p getVendorErrorDescription;
+
+	//participants
+	SiLVI_SYNC_registerParticipant_p registerParticipant;
+	SiLVI_SYNC_unregisterParticipant_p unregisterParticipant;
+	SiLVI_SYNC_setLookahead_p setLookahead;
+	SiLVI_SYNC_bindHandle_p bindHandle;
+
+	//time
+	SiLVI_SYNC_requestTimeAdvance_p requestTimeAdvance;
+
+	//extensions have to be added at the end
+}
+SiLVI_SYNC_driverFunctionTable_V3;
+
+//The symbol name to be exported by the shared library of the driver, e.g. silvi_sync_abi_3 for major ABI version 3.
+//The minor version is not included in the symbol name because higher minor versions must guarantee backward
+//compatibility to lower minor versions.
+#define SiLVI_SYNC_DRIVER_MODULE_SYMBOL_3 (silvi_sync_abi_3)
+#define SiLVI_SYNC_DRIVER_MODULE_SYMBOL_3_STR ("silvi_sync_abi_3")
@@ -1,7 +1,7 @@
 /******************************************************************
 * FILE:            SiLVI_TA.h
-* VERSION:         3.0.0.0
-* DATE:            07.03.2024
+* VERSION:         3.5.0.0
+* DATE:            18.10.2026
 * DESCRIPTION:     Interface Description File
 * COPYRIGHT:       (C) 2024 VDA SiLVI Workgroup
 *
@@ -37,6 +37,8 @@ GENERAL NOTES:
    All function pointers in the function table must be valid and match the expected function signatures.
    It is not allowed to set any of them to NULL or leave them unimplemented. However, it is allowed to implement
    functions as empty functions returning only a return value.
+   Extensions are appended at the end of SiLVI_TA_driverFunctionTable_V3 and increase the minor version.
+   Clients must check minorVersion before they access an extension.
 
 7) The API below does not have any operating system or hardware architecture dependencies.
    It is expected to work on all major operating systems on both, 32 bit and 64 bit architectures.
@@ -74,9 +76,34 @@ GENERAL NOTES:
 						Typically such changes involve comments, white spaces and source code
 						formatting only.
 
+9) Drivers reporting ABI minor version 5 or higher pass frames to the callbacks of a bus or interface in the order of
+   their reception time stamps, frames with equal reception time stamps in the order of the arbitration of the virtual
+   bus. Time stamps and order must not depend on the number of threads used by the driver or the bus simulation, so
+   they are reproducible for frames with the same send request times (see SiLVI_COM_Generic.h). Clients must check
+   minorVersion before relying on this.
+   Callbacks of different buses may be called concurrently. FlexRay channels A and B are separate buses in this
+   respect, also if their frames are merged (see SiLVI_TA_SetFlexRayChannelMerging).
+
 * Version history:
 * MAJOR_ABI.MINOR_ABI.API.COMMENT version
 * 3.0.0.0	Initial version of the test automation interface
+*
+* 3.0.0.1	Order and reproducibility of monitored frames
+*
+* 3.1.0.0	Merged monitoring of multiple interfaces
+*
+* 3.2.0.0	Flight recorder with pre- and post-trigger windows per bus
+*
+* 3.3.0.0	Bus statistics
+*
+* 3.3.0.1	Alignment and lifetime of the data passed to callbacks
+*
+* 3.3.1.0	Bus type of CAN XL buses
+*
+* 3.4.0.0	Merging of the frames of the two channels of a FlexRay cluster
+*
+* 3.5.0.0	No new members, order and reproducibility of monitored frames (note 9) and the alignment of the data passed
+*           to callbacks are guaranteed from this minor version on
 */
 
 #pragma once
@@ -93,6 +120,7 @@ typedef enum SiLVI_TA_BusType
     SiLVI_TA_FlexRay_ChA = 3,
     SiLVI_TA_FlexRay_ChB = 4,
     SiLVI_TA_LIN = 5,
+    SiLVI_TA_CANXL = 6,
     SilVI_TA_Custom = 0x128
 } SiLVI_TA_BusType;
 
@@ -154,6 +182,8 @@ typedef SiLVI_status(*SiLVI_TA_StartMonitoring)(int64_t /*BusHandle*/);
  //Don't call callbacks, don't use filters, simulation keeps running
 typedef SiLVI_status(*SiLVI_TA_StopMonitoring)(int64_t /*BusHandle*/);
 //Callbacks can slow down the simulation if they take too much time, but do not cause frame loss
+//Data is one size prefixed buffer and only valid until the callback returns. Drivers reporting ABI minor version 5 or
+//higher pass it aligned to at least 8 bytes, clients must check minorVersion before relying on the alignment
 typedef SiLVI_status(*SiLVI_TA_Callback)(const uint8_t* /*Data*/, uint64_t /*DataSize*/, void* /*UserPtr*/);
  //Only possible before StartMonitoring or after StopMonitoring with the same handle
 typedef SiLVI_status(*SiLVI_TA_RegisterBusCallback)(int64_t /*BusHandle*/, SiLVI_TA_Callback, void* /*UserPtr*/);
@@ -164,6 +194,98 @@ typedef SiLVI_status(*SiLVI_TA_RegisterInterfaceCallback)(int64_t /*InterfaceHan
  //Only possible before StartMonitoring or after StopMonitoring with the same handle
 typedef SiLVI_status(*SiLVI_TA_UnregisterInterfaceCallbacks)(int64_t /*InterfaceHandle*/);
 
+/**
+ * Merged monitoring of multiple interfaces
+ */
+//Data is one RegisterFile with the frames of all merged interfaces in the order of their reception time stamps
+//(LIN: slave_reception, master_reception for frames without slave part), see note 9 for frames with equal time stamps.
+//InterfaceHandles contains the interface handle of each MetaFrame in the same order as the buffer of the RegisterFile.
+//All frames with a reception time stamp up to Watermark (psec10, see TimeSpec in the schemas) have been passed, later
+//calls only pass frames received after it. DataSize 0 indicates a call which only advances the watermark.
+typedef SiLVI_status(*SiLVI_TA_MergedCallback)(const uint8_t* /*Data*/, uint64_t /*DataSize*/, const int64_t* /*InterfaceHandles*/, int64_t /*Watermark*/, void* /*UserPtr*/);
+//The frames of all interfaces must be serialized with the same schema, otherwise SiLVI_ERROR_INVALID_BUSTYPE is returned,
+//e.g. interfaces of SiLVI_TA_FlexRay_ChA and SiLVI_TA_FlexRay_ChB buses can be merged because both use NMF2 buffers.
+//The driver merges the streams of the interfaces and passes a frame as soon as the watermark of all merged buses allows
+//it, with at most MaxFramesPerBatch frames per call (0: no limit). The client does not need to buffer or sort frames.
+//Only possible while monitoring of the buses of the interfaces is stopped
+typedef SiLVI_status(*SiLVI_TA_RegisterMergedInterfaceCallback)(int64_t /*SimulationHandle*/, const int64_t* /*InterfaceHandles*/, uint64_t /*NumberOfInterfaces*/, SiLVI_TA_Direction, uint64_t /*MaxFramesPerBatch*/, SiLVI_TA_MergedCallback, void* /*UserPtr*/, int64_t* /*MergeHandle*/);
+//Only possible while monitoring of the buses of the interfaces is stopped
+typedef SiLVI_status(*SiLVI_TA_UnregisterMergedInterfaceCallback)(int64_t /*SimulationHandle*/, int64_t /*MergeHandle*/);
+
+/**
+ * Flight recorder
+ */
+//All times are virtual times in psec10 (see TimeSpec in the schemas), the same unit as the time stamps of the frames
+typedef struct SiLVI_TA_FlightRecorderConfig
+{
+    int64_t preTriggerTime;    //time before the trigger to be kept, 0: only limited by maxBytes - postTriggerMaxBytes
+    int64_t postTriggerTime;   //time after the trigger to be added to the snapshot
+    uint64_t maxBytes;         //size of the ring buffer of the bus, must be greater than 0, otherwise
+                               //SiLVI_ERROR_INVALID_PARAMETERS is returned
+    uint64_t postTriggerMaxBytes; //part of maxBytes reserved for the post-trigger window, must be less than maxBytes and
+                               //greater than 0 if postTriggerTime is greater than 0, otherwise
+                               //SiLVI_ERROR_INVALID_PARAMETERS is returned
+    uint8_t triggerOnRxError;  //SiLVI_True|SiLVI_False, trigger on every frame with status RxError
+    uint8_t padding[7];        //padding to avoid padding bytes inserted by the compiler
+}
+SiLVI_TA_FlightRecorderConfig;
+//Data is one RegisterFile with all frames of the bus from the pre-trigger window until the end of the post-trigger window.
+//TriggerTime is the virtual time of the trigger
+typedef SiLVI_status(*SiLVI_TA_SnapshotCallback)(const uint8_t* /*Data*/, uint64_t /*DataSize*/, int64_t /*TriggerTime*/, void* /*UserPtr*/);
+//The driver keeps the recent frames of the bus in a ring buffer of fixed size which is allocated here and overwritten in
+//place while monitoring, so memory usage does not grow with the duration of the simulation.
+//The ring buffer is split into the pre-trigger part of maxBytes - postTriggerMaxBytes bytes and the post-trigger part of
+//postTriggerMaxBytes bytes. Before a trigger the frames are written to the pre-trigger part and the oldest frames are
+//overwritten when it is full, so the pre-trigger window is shorter than preTriggerTime if its frames need more than
+//maxBytes - postTriggerMaxBytes bytes. With preTriggerTime 0 the pre-trigger window is only limited by this size.
+//After a trigger the frames are written to the post-trigger part, the pre-trigger part is not overwritten until the
+//snapshot callback has returned. If the post-trigger frames need more than postTriggerMaxBytes bytes the post-trigger
+//window ends with the last frame that fits and the snapshot callback is called early. The client can detect this by
+//comparing the time stamp of the last frame with TriggerTime + postTriggerTime. Frames after the truncated window and
+//before the end of the post-trigger window are not recorded, recording into the pre-trigger part continues with the
+//first frame after the end of the post-trigger window.
+//Only possible before StartMonitoring or after StopMonitoring with the same handle
+typedef SiLVI_status(*SiLVI_TA_EnableFlightRecorder)(int64_t /*BusHandle*/, const SiLVI_TA_FlightRecorderConfig*, SiLVI_TA_SnapshotCallback, void* /*UserPtr*/);
+//Only possible before StartMonitoring or after StopMonitoring with the same handle
+typedef SiLVI_status(*SiLVI_TA_DisableFlightRecorder)(int64_t /*BusHandle*/);
+//Triggers a snapshot at the current virtual time of the bus, e.g. from a bus callback when a frame matches a predicate.
+//The snapshot callback is called once the post-trigger window has passed. Triggers within the post-trigger window of a
+//previous trigger are part of the same snapshot
+typedef SiLVI_status(*SiLVI_TA_TriggerFlightRecorder)(int64_t /*BusHandle*/);
+
+/**
+ * Bus statistics
+ */
+//Counters of a bus since StartMonitoring. Times are virtual times in psec10 like the time stamps of the monitored
+//frames. The bus load of a time window is the difference of busyTime divided by the difference of time of two
+//snapshots. Latencies of single frames follow from MessageTiming in the monitored frames: send_request -> arbitration
+//is the queuing latency, arbitration -> reception the transmission time of the frame.
+typedef struct SiLVI_TA_BusStatistics
+{
+    int64_t time;              //virtual time of the snapshot
+    int64_t busyTime;          //virtual time the bus was occupied by frames, including all protocol overhead
+    uint64_t frames;           //number of frames transmitted on the bus
+    uint64_t errorFrames;      //number of frames received with status RxError
+    uint64_t payloadBytes;     //number of payload bytes transmitted on the bus
+}
+SiLVI_TA_BusStatistics;
+//Writes a consistent snapshot of the counters to the data structure provided by the caller. Must not block the
+//simulation and may be called from any thread, including registered callbacks.
+//Only possible between StartMonitoring and StopMonitoring
+typedef SiLVI_status(*SiLVI_TA_GetBusStatistics)(int64_t /*BusHandle*/, SiLVI_TA_BusStatistics*);
+
+/**
+ * FlexRay channel merging
+ */
+//Enables or disables the merging of the frames of the two channels of a FlexRay cluster, merging is disabled by default.
+//The rules are the same as for SiLVI_COM_setChannelMerging_flexray_p in SiLVI_COM_FlexRay.h: identical frames received
+//on both channels are passed only once with the channel mask Both, divergences are passed with the status
+//ChannelMismatch. Merged frames are passed to the callbacks and flight recorder of the channel A bus only, the callbacks
+//and flight recorder of the channel B bus only get the frames which have not been merged.
+//The bus handles must belong to the SiLVI_TA_FlexRay_ChA and SiLVI_TA_FlexRay_ChB buses of the same cluster,
+//otherwise SiLVI_ERROR_INVALID_BUSTYPE is returned.
+//Only possible while monitoring of both buses is stopped
+typedef SiLVI_status(*SiLVI_TA_SetFlexRayChannelMerging)(int64_t /*BusHandleChA*/, int64_t /*BusHandleChB*/, uint8_t /*SiLVI_True|SiLVI_False*/);
 
 //SiLVI TA ABI Version 3
 typedef struct SiLVI_TA_driverFunctionTable_V3
@@ -207,6 +329,26 @@ typedef struct SiLVI_TA_driverFunctionTable_V3
    SiLVI_TA_UnregisterBusCallbacks unregisterBusCallbacks;
    SiLVI_TA_RegisterInterfaceCallback registerInterfaceCallback;
    SiLVI_TA_UnregisterInterfaceCallbacks unregisterInterfaceCallbacks;
+
+	//extensions have to be added at the end
+
+	//ABI minor version 1: merged monitoring
+	SiLVI_TA_RegisterMergedInterfaceCallback registerMergedInterfaceCallback;
+	SiLVI_TA_UnregisterMergedInterfaceCallback unregisterMergedInterfaceCallback;
+
+	//ABI minor version 2: flight recorder
+	SiLVI_TA_EnableFlightRecorder enableFlightRecorder;
+	SiLVI_TA_DisableFlightRecorder disableFlightRecorder;
+	SiLVI_TA_TriggerFlightRecorder triggerFlightRecorder;
+
+	//ABI minor version 3: bus statistics
+	SiLVI_TA_GetBusStatistics getBusStatistics;
+
+	//ABI minor version 4: FlexRay channel merging
+	SiLVI_TA_SetFlexRayChannelMerging setFlexRayChannelMerging;
+
+	//ABI minor version 5: no new members, order and reproducibility of monitored frames (see note 9) and alignment
+	//of the data passed to callbacks
 }
 SiLVI_TA_driverFunctionTable_V3;
 
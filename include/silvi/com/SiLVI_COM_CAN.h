@@ -1,7 +1,7 @@
 /******************************************************************
 * FILE:            SiLVI_COM_CAN.h
-* VERSION:         3.0.0.0
-* DATE:            07.03.2024
+* VERSION:         3.1.1.0
+* DATE:            18.10.2026
 * DESCRIPTION:     Interface Description File
 * COPYRIGHT:       (C) 2024 VDA SiLVI Workgroup
 *
@@ -18,8 +18,13 @@ SiLVI API and ABI description
 * Version history:
 * MAJOR_ABI.MINOR_ABI.API.COMMENT version
 * 3.0.0.0	Introduced separate file for CAN
+*
+* 3.1.1.0	FlatBuffers file identifier of the frame buffers
 */
 
+//file identifier of the size prefixed frame buffers (NetworkModels.CAN.V2.RegisterFile in network_model_can.fbs)
+#define SiLVI_COM_CAN_FILE_IDENTIFIER "NMC2"
+
 //CAN parameters - bus configuration is part of the network simulation
 typedef struct SiLVI_COM_CAN_Parameters
 {
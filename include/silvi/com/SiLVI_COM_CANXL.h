@@ -0,0 +1,137 @@
+/******************************************************************
+* FILE:            SiLVI_COM_CANXL.h
+* VERSION:         3.1.1.0
+* DATE:            18.10.2026
+* DESCRIPTION:     Interface Description File
+* COPYRIGHT:       (C) 2024 VDA SiLVI Workgroup
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+******************************************************************/
+
+#pragma once
+#include "silvi/core/SiLVI_BaseDefs.h"
+
+/*
+SiLVI API and ABI description
+
+* Version history:
+* MAJOR_ABI.MINOR_ABI.API.COMMENT version
+* 3.1.0.0	Introduced separate file for CAN XL
+*
+* 3.1.1.0	FlatBuffers file identifier of the frame buffers
+*/
+
+//file identifier of the size prefixed frame buffers (NetworkModels.CANXL.RegisterFile in network_model_canxl.fbs)
+#define SiLVI_COM_CANXL_FILE_IDENTIFIER "NMXL"
+
+//maximum payload length of a CAN XL frame in bytes, see length in network_model_canxl.fbs
+#define SiLVI_COM_CANXL_MAX_PAYLOAD_LENGTH 2048
+
+//CAN XL data phase mode, corresponds to ArbitDataPhase_Mode in network_model_canxl.fbs
+typedef enum SiLVI_COM_CANXL_DataPhaseMode
+{
+	SiLVI_CANXL_FD_MODE = 0,    //FD data phase
+	SiLVI_CANXL_SIC_MODE = 1    //XL data phase with SIC transceiver
+}
+SiLVI_COM_CANXL_DataPhaseMode;
+
+//CAN XL parameters - bus configuration is part of the network simulation
+typedef struct SiLVI_COM_CANXL_Parameters
+{
+	uint32_t baudRate;                           //arbitration baud rate in bps
+	SiLVI_COM_CANXL_DataPhaseMode dataPhaseMode; //data phase mode of the controller
+	uint8_t selfReception;                       //SiLVI_True|SiLVI_False, self reception is used to receive a copy of the data that is sent to the bus
+	uint8_t fastDataEnabled;                     //SiLVI_True|SiLVI_False, flag if CAN FD frames are enabled, if set to false fastBaudRate is ignored
+	uint8_t padding[6];                          //padding to avoid padding bytes inserted by the compiler
+	uint64_t fastBaudRate;                       //CAN FD data phase baud rate in bps
+	uint64_t xlBaudRate;                         //CAN XL data phase baud rate in bps
+}
+SiLVI_COM_CANXL_Parameters;
+
+/*
+* @brief Initialization of the bus interface
+* @param [in] points to a handle to be returned
+* @param [in] logical name of the interface to open, e.g. "CANXL:0".
+*             It is used to identify the interface/channel to be opened.
+*             Useful if the model opens multiple interfaces.
+* @param [in] the configration data structure
+* @return status indicating success or failure of the operation
+*
+* Example
+* int32_t canxl_handle;
+* SiLVI_COM_CANXL_Parameters canxl_params;
+* canxl_params.selfReception = SiLVI_False;
+* canxl_params.baudRate = 500*1000;
+* canxl_params.fastDataEnabled = SiLVI_True;
+* canxl_params.fastBaudRate = 2*1000*1000;
+* canxl_params.xlBaudRate = 10*1000*1000;
+* canxl_params.dataPhaseMode = SiLVI_CANXL_SIC_MODE;
+* if (ptr->minorVersion >= 1)
+*     result = ptr->canxl.initialize(&canxl_handle, "CANXL:0", canxl_params);
+*
+* The frames are exchanged in the format of network_model_canxl.fbs (file identifier "NMXL").
+* Frames carry up to SiLVI_COM_CANXL_MAX_PAYLOAD_LENGTH payload bytes, which is much more than the payload
+* of classical CAN frames. Clients are expected to reuse their receive buffers across SiLVI_COM_rxFrame_p calls
+* and only to enlarge them on SiLVI_ERROR_ALLOCATED_MEMORY_TOO_SMALL. Since the payload vector of a frame may be
+* longer than its length, drivers can serialize payloads from fixed size frame buffers without trimming them.
+*
+* MULTIPLE CALLS AND MULTIPLE OPENS
+*
+* It is allowed to open the same interface (with same logical name) multiple times.
+* In such cases different handles shall be returned by the driver.
+*
+* It is allowed to close and reopen the same interface during simulation, even multiple times.
+* However, different handles shall be returned on subsequent calls of SiLVI_COM_initialize_canxl_p().
+* Existing handles must become invalid after they have been passed to SiLVI_COM_terminate_p().
+*
+* This function is allowed to block until the bus is available and/or the bus interface can be
+* used. The virtual bus is expected to be fully operational when SiLVI_COM_initialize_canxl_p() has
+* successfully returned.
+* A possible start-up or synchronisation phase of the virtual bus shall not be observable for the
+* SiLVI client application.
+*
+* Each handle returned by a SiLVI_COM_initialize_canxl_p() call must be closed by calling
+* SiLVI_COM_terminate_p().
+*/
+typedef SiLVI_status(*SiLVI_COM_initialize_canxl_p)(int32_t*, const char*, const SiLVI_COM_CANXL_Parameters);
+
+/*
+* @brief Initialization of the bus interface with auto configuration
+* @param [in]     points to a handle to be returned
+* @param [in]     logical name of the interface to open, e.g. "CANXL:0".
+*                 It is used to identify the interface/channel to be opened.
+*                 Useful if the model opens multiple interfaces.
+* @param [in|out] a pointer to the data structure where the driver can store the configuration
+*                 If this pointer is set to NULL then no configuration data will be written by the
+*                 driver
+* @return status indicating success or failure of the operation
+*
+* Example 1 - auto configuration without getting the configuration
+* int32_t canxl_handle;
+* result = ptr->canxl.auto_initialize(&canxl_handle, "CANXL:0", NULL);
+*
+* Example 2 - auto configuration with getting the configuration
+* int32_t canxl_handle;
+* SiLVI_COM_CANXL_Parameters canxl_params;
+* result = ptr->canxl.auto_initialize(&canxl_handle, "CANXL:0", &canxl_params);
+*
+* In addition to the described auto configuration options the implementation must provide the same
+* behaviour like SiLVI_COM_initialize_canxl_p
+*
+*/
+typedef SiLVI_status(*SiLVI_COM_auto_initialize_canxl_p)(int32_t*, const char*, SiLVI_COM_CANXL_Parameters*);
+
+//SiLVI ABI Version 3
+typedef struct SiLVI_driverFunctionTable_CANXL_V3
+{
+	//padding 32 bit word to avoid padding bytes inserted by the compiler
+	uint32_t padding;
+
+	//initialize and auto initialize
+	SiLVI_COM_initialize_canxl_p initialize;
+	SiLVI_COM_auto_initialize_canxl_p auto_initialize;
+
+	// extensions have to be added at the end
+}
+SiLVI_COM_driverFunctionTable_CANXL_V3;
@@ -0,0 +1,97 @@
+/******************************************************************
+* FILE:            SiLVI_COM_Clock.h
+* VERSION:         3.6.0.0
+* DATE:            18.10.2026
+* DESCRIPTION:     Interface Description File
+* COPYRIGHT:       (C) 2024 VDA SiLVI Workgroup
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+******************************************************************/
+
+#pragma once
+#include "silvi/core/SiLVI_BaseDefs.h"
+
+/*
+SiLVI API and ABI description
+
+* Version history:
+* MAJOR_ABI.MINOR_ABI.API.COMMENT version
+* 3.6.0.0	Introduced separate file for the shared simulation clock
+*/
+
+/*
+ * Simulation clock shared by the driver
+ *
+ * The driver publishes the simulation time of a virtual bus in this data structure so that clients can read it
+ * without calling into the driver. The driver allocates it aligned to 64 bytes, so it occupies a cache line of its
+ * own, and it may be located in memory shared with other processes.
+ *
+ * The time is protected by a sequence counter (seqlock). The driver updates the clock as follows:
+ *   sequence is incremented (odd), release fence, time and psec10 are written, release fence,
+ *   sequence is incremented (even)
+ * A reader reads sequence, then time and psec10, then sequence again (with acquire fences in between) and repeats
+ * this if sequence was odd or has changed. SiLVI_COM_readSimulationClock below implements the reader.
+ */
+typedef struct SiLVI_COM_SimulationClock
+{
+	volatile uint32_t sequence;   //sequence counter, odd while the driver updates the time
+	uint32_t padding;             //padding 32 bit word to avoid padding bytes inserted by the compiler
+	volatile uint64_t time;       //simulation time in ns, the same as returned by SiLVI_COM_getSimulationTime_p
+	volatile int64_t psec10;      //simulation time in tens of picoseconds, see TimeSpec in the schemas
+	uint8_t reserved[40];         //reserved, fills the cache line
+}
+SiLVI_COM_SimulationClock;
+
+/*
+ * @brief Returns the shared simulation clock of the virtual bus of the handle
+ * The clock remains valid until the handle is passed to SiLVI_COM_terminate_p. Different handles of the same
+ * virtual bus may return the same clock.
+ * If the driver cannot provide a shared clock this function must fail by returning SiLVI_ERROR_NOT_IMPLEMENTED.
+ * In that case the simulation time shall be read by calling SiLVI_COM_getSimulationTime_p.
+ * @param [in] handle returned by the init function
+ * @param [out] pointer to a variable where the pointer to the clock is to be stored
+ * @return status indicating success or failure of the operation
+ */
+typedef SiLVI_status(*SiLVI_COM_getSimulationClock_p)(int32_t, const SiLVI_COM_SimulationClock**);
+
+/*
+ * Optional inline reader of the clock, only available for compilers with a known acquire fence
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define SiLVI_COM_CLOCK_ACQUIRE_FENCE() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+#include <intrin.h>
+#define SiLVI_COM_CLOCK_ACQUIRE_FENCE() __dmb(_ARM64_BARRIER_ISH)
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#define SiLVI_COM_CLOCK_ACQUIRE_FENCE() _ReadWriteBarrier()
+#endif
+
+#ifdef SiLVI_COM_CLOCK_ACQUIRE_FENCE
+/*
+ * @brief Reads the simulation time from a clock returned by SiLVI_COM_getSimulationClock_p
+ * @param [in] the clock
+ * @param [out] pointer to a variable where the time in tens of picoseconds is to be stored, can be NULL if not needed
+ * @return the simulation time in ns
+ */
+static inline uint64_t SiLVI_COM_readSimulationClock(const SiLVI_COM_SimulationClock* clock, int64_t* psec10)
+{
+	uint32_t sequence;
+	uint64_t time;
+	int64_t time_psec10;
+	do
+	{
+		sequence = clock->sequence;
+		SiLVI_COM_CLOCK_ACQUIRE_FENCE();
+		time = clock->time;
+		time_psec10 = clock->psec10;
+		SiLVI_COM_CLOCK_ACQUIRE_FENCE();
+	}
+	while ((sequence & 1u) || sequence != clock->sequence);
+
+	if (psec10)
+		*psec10 = time_psec10;
+	return time;
+}
+#endif
@@ -1,7 +1,7 @@
 /******************************************************************
 * FILE:            SiLVI_COM_Ethernet.h
-* VERSION:         3.0.0.0
-* DATE:            07.03.2024
+* VERSION:         3.7.0.0
+* DATE:            18.10.2026
 * DESCRIPTION:     Interface Description File
 * COPYRIGHT:       (C) 2024 VDA SiLVI Workgroup
 *
@@ -18,8 +18,15 @@ SiLVI API and ABI description
 * Version history:
 * MAJOR_ABI.MINOR_ABI.API.COMMENT version
 * 3.0.0.0	Introduced separate file for Ethernet
+*
+* 3.1.1.0	FlatBuffers file identifier of the frame buffers
+*
+* 3.7.0.0	Egress model: priority queues, credit based and time aware shaping
 */
 
+//file identifier of the size prefixed frame buffers (NetworkModels.Ethernet.RegisterFile in network_model_ethernet.fbs)
+#define SiLVI_COM_ETHERNET_FILE_IDENTIFIER "NME2"
+
 //ethernet
 typedef struct { uint8_t bytes[6]; } SiLVI_COM_Ethernet_MAC_Addr;
 typedef enum SiLVI_COM_Ethernet_Speed
@@ -169,6 +176,87 @@ typedef SiLVI_status(*SiLVI_COM_reconfigure_ethernet_vLan_p)(int32_t, const SiLV
 */
 typedef SiLVI_status(*SiLVI_COM_reconfigure_ethernet_multiCast_p)(int32_t, const SiLVI_COM_Ethernet_Multicast_Addr_List);
 
+/*
+* EGRESS MODEL
+*
+* Each interface has one egress queue per traffic class. The traffic class of a frame follows from the PCP of its
+* VLAN tag via the table pcpToTrafficClass of the egress parameters, frames without VLAN tag have the priority 0.
+* By default the table is the priority to traffic class mapping recommended by IEEE 802.1Q for 8 traffic classes,
+* so PCP 1 (background) ranks below PCP 0 (best effort). Frames of a higher traffic class are transmitted first
+* (strict priority) unless they are held back by the shaper of their traffic class.
+* A frame occupies the link for (8 + frame size + 12) * 8 bit times at maxSpeed, where 8 bytes are preamble and
+* start frame delimiter, the frame size includes padding and FCS and 12 bytes are the inter frame gap.
+* The gate of a traffic class must be open for the whole transmission of a frame (implicit guard band of IEEE 802.1Qbv):
+* a frame only starts if its transmission ends before the gate of its traffic class closes according to the gate
+* control list, otherwise it waits for the next window of the gate which is long enough. Frames of lower traffic
+* classes whose gates are open may be transmitted in the meantime under the same condition. A frame whose
+* transmission is longer than every window of its gate is discarded when it reaches the head of its queue, so it does
+* not block the following frames of its traffic class.
+* The time stamps of the MessageTiming of a frame (see network_model_ethernet.fbs) follow from this model:
+* send_request is the time of SiLVI_COM_txFrame_p, arbitration the start of the transmission after queuing and
+* shaping, reception the end of the reception of the frame.
+*/
+
+//number of traffic classes, one per PCP value
+#define SiLVI_COM_ETHERNET_TRAFFIC_CLASSES 8
+
+//recommended priority to traffic class mapping of IEEE 802.1Q for 8 traffic classes, index is the PCP
+#define SiLVI_COM_ETHERNET_DEFAULT_PCP_TO_TRAFFIC_CLASS { 1, 0, 2, 3, 4, 5, 6, 7 }
+
+typedef enum SiLVI_COM_Ethernet_Shaper
+{
+	SiLVI_ETHERNET_SHAPER_NONE = 0,          //strict priority only
+	SiLVI_ETHERNET_SHAPER_CREDIT_BASED = 1   //credit based shaper (IEEE 802.1Qav)
+}
+SiLVI_COM_Ethernet_Shaper;
+
+//entry of the gate control list of the time aware shaper (IEEE 802.1Qbv)
+typedef struct SiLVI_COM_Ethernet_Gate_Control_Entry
+{
+	uint8_t gateStates;      //bit n set: the gate of traffic class n is open
+	uint8_t padding[3];      //padding to avoid padding bytes inserted by the compiler
+	uint32_t timeInterval;   //duration of the entry in ns
+}
+SiLVI_COM_Ethernet_Gate_Control_Entry;
+
+typedef struct SiLVI_COM_Ethernet_Gate_Control_List
+{
+	SiLVI_COM_Ethernet_Gate_Control_Entry* entries; //entries of one cycle, the cycle time is the sum of their durations
+	                                                //the pointer is only valid in the respective function call. For this
+	                                                //reason the driver implementation has to create and manage an internal
+	                                                //copy of the data if it is reused.
+	uint64_t cnt;                                   //number of entries. If cnt is 0 entries must be NULL and all gates are open
+	uint64_t baseTime;                              //virtual time in ns when the first cycle starts
+}
+SiLVI_COM_Ethernet_Gate_Control_List;
+
+//Ethernet egress parameters
+typedef struct SiLVI_COM_Ethernet_Egress_Parameters
+{
+	SiLVI_COM_Ethernet_Shaper shaper[SiLVI_COM_ETHERNET_TRAFFIC_CLASSES];  //shaper of each traffic class
+	uint8_t pcpToTrafficClass[SiLVI_COM_ETHERNET_TRAFFIC_CLASSES];         //traffic class of each PCP value, 0...7,
+	                                                                       //e.g. SiLVI_COM_ETHERNET_DEFAULT_PCP_TO_TRAFFIC_CLASS
+	uint64_t idleSlope[SiLVI_COM_ETHERNET_TRAFFIC_CLASSES];                //credit based shaper: idle slope in bit/s
+	SiLVI_COM_Ethernet_Gate_Control_List gateControl;                      //time aware shaper
+}
+SiLVI_COM_Ethernet_Egress_Parameters;
+
+/*
+* @brief Change the egress configuration of an existing interface
+* Without a call of this function all traffic classes use strict priority without shaping, all gates are open and
+* the PCP values are mapped to traffic classes by SiLVI_COM_ETHERNET_DEFAULT_PCP_TO_TRAFFIC_CLASS.
+*
+* SiLVI_ERROR_INVALID_PARAMETERS is returned and the configuration is not changed if an entry of pcpToTrafficClass
+* is greater than 7, if the idle slope of a traffic class with a credit based shaper is 0 or if the sum of the idle
+* slopes of all traffic classes with a credit based shaper is greater than maxSpeed of the interface.
+*
+* @param [in] handle returned by the init function
+* @param [in] the new configuration.
+* @return Status indicating success or failure of the operation.
+*
+*/
+typedef SiLVI_status(*SiLVI_COM_reconfigure_ethernet_egress_p)(int32_t, const SiLVI_COM_Ethernet_Egress_Parameters);
+
 //SiLVI ABI Version 3
 typedef struct SiLVI_driverFunctionTable_Ethernet_V3
 {
@@ -1,7 +1,7 @@
 /******************************************************************
 * FILE:            SiLVI_COM_FlexRay.h
-* VERSION:         3.0.0.0
-* DATE:            07.03.2024
+* VERSION:         3.5.0.0
+* DATE:            18.10.2026
 * DESCRIPTION:     Interface Description File
 * COPYRIGHT:       (C) 2024 VDA SiLVI Workgroup
 *
@@ -18,8 +18,15 @@ SiLVI API and ABI description
 * Version history:
 * MAJOR_ABI.MINOR_ABI.API.COMMENT version
 * 3.0.0.0	Introduced separate file for Flexray
+*
+* 3.1.1.0	FlatBuffers file identifier of the frame buffers
+*
+* 3.5.0.0	Merging of frames received on both channels
 */
 
+//file identifier of the size prefixed frame buffers (NetworkModels.FlexRay.RegisterFile in network_model_flexray.fbs)
+#define SiLVI_COM_FLEXRAY_FILE_IDENTIFIER "NMF2"
+
 //FlexRay channel
 typedef enum SiLVI_COM_FlexRay_Channel
 {
@@ -92,6 +99,29 @@ typedef SiLVI_status(*SiLVI_COM_initialize_flexray_p)(int32_t*, const char*, con
 */
 typedef SiLVI_status(*SiLVI_COM_auto_initialize_flexray_p)(int32_t*, const char*, SiLVI_COM_FlexRay_Parameters*);
 
+/*
+* @brief Enable or disable the merging of frames received on both channels
+* @param [in] handle returned by the init function
+* @param [in] SiLVI_True|SiLVI_False, merging is disabled by default
+* @return status indicating success or failure of the operation
+*
+* Without merging a frame sent on both channels is received twice, once with channel A and once with channel B.
+* With merging the frame is passed only once with the channel mask Both if the frames received on channel A and
+* channel B in the same slot and cycle are identical. Identical means that all fields of the Frame table are equal
+* (frame_id, indicators, length, cycle and the first 2 * length bytes of data). The time stamps are not compared,
+* the merged frame has the timing of the frame with the earlier reception time stamp.
+* If the frames differ then both frames are passed with the status ChannelMismatch (see network_model_flexray.fbs),
+* so only real divergences between the channels have to be handled. This also applies if a frame sent on both
+* channels is received on one channel only, the received frame is then passed with ChannelMismatch.
+* If one of the two frames has the status RxError it keeps this status and the other one is passed with
+* ChannelMismatch.
+* Frames sent on one channel only are passed unchanged with the channel mask of that channel.
+* The setting takes effect for all frames received after this call.
+* The same merging of the monitored frames is available for the test automation interface, see
+* SiLVI_TA_SetFlexRayChannelMerging in SiLVI_TA.h.
+*/
+typedef SiLVI_status(*SiLVI_COM_setChannelMerging_flexray_p)(int32_t, uint8_t);
+
 //SiLVI ABI Version 3
 typedef struct SiLVI_driverFunctionTable_Flexray_V3
 {
@@ -1,7 +1,7 @@
 /******************************************************************
 * FILE:            SiLVI_COM_Generic.h
-* VERSION:         3.0.0.0
-* DATE:            07.03.2024
+* VERSION:         3.9.0.0
+* DATE:            18.10.2026
 * DESCRIPTION:     Interface Description File
 * COPYRIGHT:       (C) 2024 VDA SiLVI Workgroup
 *
@@ -18,8 +18,117 @@ SiLVI API and ABI description
 * Version history:
 * MAJOR_ABI.MINOR_ABI.API.COMMENT version
 * 3.0.0.0	Introduced separate file for the generic parts
+*
+* 3.0.1.0	Recommended syntax of logical interface names and prefixes of the bus types
+*           Handles are local to the driver that returned them, common time base of all handles
+*
+* 3.1.0.0	Prefix of the CAN XL bus type
+*
+* 3.1.0.1	Order and reproducibility of received frames
+*
+* 3.2.0.0	Bus type enumeration and auto initialization of multiple interfaces in one call
+*
+* 3.3.0.0	Client executors and CPU affinity for the delivery of RX callbacks
+*
+* 3.4.0.0	Timer callbacks at a virtual time
+*
+* 3.6.0.1	Alignment and lifetime of buffers passed to the client
+*
+* 3.7.0.1	Buffers passed to the driver may be preassembled templates
+*
+* 3.8.0.0	Cyclic transmission of frames by the driver
+*
+* 3.9.0.0	Padding of the payloads of received frames
+*           Alignment of buffers passed to the client, order and reproducibility of received frames are guaranteed
+*           from ABI minor version 9 on
 */
 
+/*
+ * LOGICAL INTERFACE NAMES
+ *
+ * The logical name passed to the initialize and auto_initialize functions of the bus types should have the syntax
+ *
+ *   <bus type prefix>:<channel>
+ *
+ * e.g. "CAN:0" or "ETHERNET:1". The prefix identifies the bus type and is one of the prefixes defined below,
+ * the channel identifies the interface of that bus type. The prefix is case sensitive.
+ * This syntax is a recommendation: drivers may accept other logical names, and clients using other names must
+ * not expect a driver to reject them. A driver may reject a logical name whose prefix is one of the prefixes
+ * below but does not match the bus type of the called initialize function with SiLVI_ERROR_INVALID_NAME.
+ *
+ * If the clients of a driver follow the syntax, the bus type can be derived from the prefix alone. A driver
+ * which forwards the interfaces to other drivers (e.g. one driver per bus simulator) can then select the target
+ * driver in the initialize call and does not need to look at the name again afterwards.
+ *
+ * HANDLES
+ *
+ * Handles returned by the initialize functions are only valid for the driver that returned them.
+ * A forwarding driver as described above has to return handles of its own and translate them to the handles
+ * of the target driver, including the handle passed to SiLVI_COM_rxCallbackFunction_p.
+ *
+ * The simulation time of all handles of a driver (see SiLVI_COM_getSimulationTime_p) and the time stamps of
+ * their frames refer to one time base: 0 is the start of the simulation. Times of different handles can
+ * therefore be compared, even if their virtual buses are simulated by different bus simulations.
+ * A forwarding driver whose target drivers use different time bases, e.g. because the bus simulations were
+ * started one after another, has to translate the times and time stamps of each target driver to the common
+ * time base. Virtual buses simulated independently may have reached different times at the same moment, so
+ * getSimulationTime of two handles may still return different values; the times are equal once both buses
+ * have been synchronized, e.g. via SiLVI_SYNC.h.
+ *
+ * ORDER AND REPRODUCIBILITY OF RECEIVED FRAMES
+ *
+ * The following rules apply to drivers reporting ABI minor version 9 or higher in SiLVI_COM_driverFunctionTable_V3.
+ * Clients must check minorVersion before relying on them.
+ *
+ * Frames received via one handle are delivered in the order of their reception time stamps. Frames with equal
+ * reception time stamps are delivered in the order of the arbitration of the virtual bus.
+ * The time stamps and the order of received frames must only depend on the simulated network and the frames sent to
+ * it including their send request times, but not on the number of threads of the driver or the bus simulation.
+ * Running the same simulation twice with the same frames and the same send request times must result in the same
+ * received frames.
+ * The send request time of a frame passed to SiLVI_COM_txFrame_p is the simulation time at the call, which depends
+ * on the timing of the host unless the handle is bound to a participant of the time synchronization (see
+ * SiLVI_SYNC_bindHandle_p in SiLVI_SYNC.h). So only simulations whose sending handles are all bound to participants
+ * are reproducible as a whole.
+ * No order is defined between frames of different handles. Virtual buses only interact via gateways, so a bus
+ * simulation may simulate them independently, e.g. one bus or FlexRay channel per thread, as long as the rules
+ * above are kept. Callbacks registered for different handles may therefore be called concurrently.
+ *
+ * BUFFERS PASSED TO THE CLIENT
+ *
+ * A buffer passed to SiLVI_COM_rxCallbackFunction_p contains exactly one size prefixed buffer of the serialization
+ * schema. SiLVI_COM_rxFrame_p writes it to the beginning of the caller's buffer.
+ * Drivers reporting ABI minor version 9 or higher in SiLVI_COM_driverFunctionTable_V3 pass buffers to RX callback
+ * functions starting at an address aligned to at least 8 bytes. Buffers written by SiLVI_COM_rxFrame_p are aligned in
+ * the same way if the caller's buffer is aligned to 8 bytes. Clients can therefore access the frames in place, e.g.
+ * decode the fields of all frames into arrays and refer to payloads by their offset and length in the buffer instead
+ * of copying them. Clients must check minorVersion before relying on the alignment: drivers with a lower minor
+ * version may pass buffers at any address, so clients copy them to an aligned buffer before accessing them in place.
+ * The buffer passed to an RX callback function is only valid until the callback returns. References into the buffer
+ * must not be used afterwards - either the frames are processed within the callback or the whole buffer is copied.
+ *
+ * Drivers reporting ABI minor version 9 or higher in SiLVI_COM_driverFunctionTable_V3 pad the payload vectors of
+ * received CAN, CAN XL, LIN and FlexRay frames with zero bytes to a multiple of 8 bytes (at least 8 bytes), so signals
+ * can be extracted with 64 bit loads without checking the size of the vector. Clients must check minorVersion before
+ * relying on this: drivers with a lower minor version may pass payload vectors of exactly the payload length.
+ * This does not apply to buffers passed via the test automation interface (SiLVI_TA.h).
+ *
+ * BUFFERS PASSED TO THE DRIVER
+ *
+ * Drivers must accept every valid buffer of the serialization schema regardless of how it was built, in particular
+ * buffers with fields stored although they have their default value (e.g. built with ForceDefaults) and payload
+ * vectors longer than the length of the payload. This allows clients to serialize the frames of cyclic messages
+ * only once into a template buffer, to remember the offsets of the payloads and length fields and to patch only
+ * those before each call of SiLVI_COM_txFrame_p instead of building a new buffer.
+ */
+#define SiLVI_COM_LOGICAL_NAME_SEPARATOR ':'
+#define SiLVI_COM_LOGICAL_NAME_PREFIX_CAN "CAN"
+#define SiLVI_COM_LOGICAL_NAME_PREFIX_LIN "LIN"
+#define SiLVI_COM_LOGICAL_NAME_PREFIX_FLEXRAY "FLEXRAY"
+#define SiLVI_COM_LOGICAL_NAME_PREFIX_ETHERNET "ETHERNET"
+#define SiLVI_COM_LOGICAL_NAME_PREFIX_CUSTOM_BUS "CUSTOM"
+#define SiLVI_COM_LOGICAL_NAME_PREFIX_CANXL "CANXL"
+
 /*
  * @brief Termination to tear down a connections to virtual bus represented by the handle.
  * The handle is considered as invalid after this function call. To use the interface again a new
@@ -148,3 +257,227 @@ typedef void (*SiLVI_COM_rxCallbackFunction_p)(int32_t, const uint8_t*, uint64_t
  * should be buffered internally until the client calls rxFrame() or registers another callback function.
  */
 typedef SiLVI_status(*SiLVI_COM_registerRxFrameCB_p)(int32_t, SiLVI_COM_rxCallbackFunction_p, void*);
+
+/*
+ * @brief A task of the driver to be run by an executor of the client, see SiLVI_COM_registerRxExecutor_p
+ * @param [in] context information of the task, owned by the driver
+ */
+typedef void (*SiLVI_COM_task_p)(void*);
+
+/*
+ * @brief A function of the client that posts a task to its executor, e.g. to the event loop of the thread that owns
+ * the state of the model. The executor must run each posted task exactly once and in the order of posting.
+ * This function must not block and must not run the task before it returns.
+ * @param [in] the task to be run
+ * @param [in] context information to be passed to the task
+ * @param [in] context information of the executor passed to SiLVI_COM_registerRxExecutor_p
+ */
+typedef void (*SiLVI_COM_executorPost_p)(SiLVI_COM_task_p, void*, void*);
+
+/*
+ * @brief Register an executor for the delivery of received frames
+ * When an executor is registered the driver does not call the RX callback function of the handle from its own
+ * threads anymore. Instead it posts a task to the executor which calls the RX callback function, so the callback
+ * runs in the thread of the client's choice and the client does not need to protect its data against concurrent
+ * access by the driver. The frames remain valid until the task has returned.
+ *
+ * Each posted task must be run, even if the handle has been passed to SiLVI_COM_terminate_p or the executor has been
+ * replaced or removed by another call of this function in the meantime. The context of a task stays valid until the
+ * task has run. A task of a terminated handle or of a replaced executor does not call the RX callback function anymore,
+ * it only releases its context, so running it is always safe. Frames of such tasks are lost like pending frames on
+ * termination. A client must therefore not unload the driver library while tasks posted by the driver are pending:
+ * it terminates all handles and then runs the remaining tasks of its executor before unloading the driver.
+ *
+ * If a CPU set has been assigned to the handle via SiLVI_COM_setRxAffinity_p as well, the RX callback function is
+ * called by the executor only and the CPU set applies to the threads of the driver that receive the frames and post
+ * the tasks, and to the placement of their buffers.
+ * @param [in] handle returned by the init function
+ * @param [in] post function of the executor or NULL to restore the delivery from threads of the driver
+ * @param [in] context information to be passed to the post function, can be NULL if not needed
+ * @return status indicating success or failure of the operation
+ */
+typedef SiLVI_status(*SiLVI_COM_registerRxExecutor_p)(int32_t, SiLVI_COM_executorPost_p, void*);
+
+/*
+ * @brief Restrict the delivery of received frames of a handle to a set of CPUs
+ * The driver calls the RX callback function of the handle only from threads running on the given CPUs and
+ * allocates its buffers for the handle close to them, e.g. on the same NUMA node.
+ * If the operating system does not support CPU affinity this function must fail by returning
+ * SiLVI_ERROR_NOT_IMPLEMENTED.
+ * @param [in] handle returned by the init function
+ * @param [in] CPU set as bit mask, bit n of word w is set for the CPU with the index 64 * w + n,
+ *             NULL to remove the restriction
+ * @param [in] number of 64 bit words of the CPU set
+ * @return status indicating success or failure of the operation
+ */
+typedef SiLVI_status(*SiLVI_COM_setRxAffinity_p)(int32_t, const uint64_t*, uint64_t);
+
+/*
+ * @brief A callback function that gets called by the driver when the simulation time of a virtual bus has reached
+ * the time of a timer registered via SiLVI_COM_registerTimerCallback_p
+ * @param [in] handle returned by the init function, can be used inside of the callback for further API calls
+ * @param [in] the current simulation time of the virtual bus in ns
+ * @param [in] user defined context information to be passed to the callback, can be NULL if not needed
+ */
+typedef void (*SiLVI_COM_timerCallbackFunction_p)(int32_t, uint64_t, void*);
+
+/*
+ * @brief Register a timer which calls a callback function once at a virtual time
+ * This allows clients to wait for a virtual time, e.g. for a deadline of an expected response, without polling
+ * SiLVI_COM_getSimulationTime_p. All frames of the handle with a reception time stamp up to the time of the timer
+ * are passed to the RX callback function before the timer callback is called.
+ * If the time has already been reached the callback is called as soon as possible, but not within this call.
+ * The timer callback is called in the same way as the RX callback function, so it is posted to the executor of the
+ * handle if one is registered (see SiLVI_COM_registerRxExecutor_p).
+ * Timers are notifications only: the simulation does not wait for the callback and does not stop at the time of
+ * the timer. Stepping of and synchronizing with virtual buses is done via SiLVI_SYNC.h.
+ * @param [in] handle returned by the init function
+ * @param [in] virtual time in ns at which the callback is to be called
+ * @param [in] pointer to the callback function
+ * @param [in] pointer to context information to be passed to the callback, can be NULL if not needed
+ * @param [out] pointer to a variable where the id of the timer is to be stored, can be NULL if not needed
+ * @return status indicating success or failure of the operation
+ *         Shall be SiLVI_ERROR_SIMULATION_NOT_RUNNING if the bus simulation is not yet running
+ */
+typedef SiLVI_status(*SiLVI_COM_registerTimerCallback_p)(int32_t, uint64_t, SiLVI_COM_timerCallbackFunction_p, void*, uint64_t*);
+
+/*
+ * @brief Cancel a timer that has not been called yet
+ * @param [in] handle returned by the init function
+ * @param [in] id of the timer returned by SiLVI_COM_registerTimerCallback_p
+ * @return status indicating success or failure of the operation
+ *         SiLVI_ERROR_INVALID_INDEX if there is no pending timer with this id
+ */
+typedef SiLVI_status(*SiLVI_COM_cancelTimerCallback_p)(int32_t, uint64_t);
+
+/*
+ * @brief Register a frame to be sent cyclically by the driver
+ * The driver sends the frame at all virtual times t with t % period == phase, starting with the first such time
+ * after this call, until the frame is unregistered or the handle is terminated. Each transmission behaves like a
+ * call of SiLVI_COM_txFrame_p at time t, so the client does not need to call SiLVI_COM_txFrame_p for cyclic frames.
+ * Malformed frames are reported immediately, errors of single transmissions are not reported.
+ * CAN, CAN XL and Ethernet frames are supported without restrictions.
+ * Frames of custom buses are not supported because their payload is not defined by the SiLVI schemas and can't be
+ * updated by SiLVI_COM_updateCyclicPayload_p - this function must return SiLVI_ERROR_INVALID_BUSTYPE for custom bus
+ * handles.
+ * FlexRay frames are not supported because their cycles are already described by cycle_period and cycle_offset
+ * in the MetaFrame - this function must return SiLVI_ERROR_INVALID_BUSTYPE for FlexRay handles.
+ * LIN frames are only supported for LIN handles in master mode (masterMode of SiLVI_COM_LIN_Parameters), since
+ * only the master initiates LIN frames: the driver sends the header of the frame at the times above, like an entry
+ * of the schedule table of the master, and the response of the master if the frame has the flag Master. Otherwise
+ * the response is sent by the slave as usual. LIN slaves cannot transmit on their own, so this function must return
+ * SiLVI_ERROR_INVALID_PARAMETERS for LIN handles in slave mode.
+ * @param [in] handle returned by the init function
+ * @param [in] pointer to a buffer containing exactly one frame
+ * @param [in] size of the buffer
+ * @param [in] period in ns, must be greater than 0
+ * @param [in] phase in ns, must be smaller than the period
+ * @param [out] pointer to a variable where the id of the cyclic frame is to be stored
+ * @return status indicating success or failure of the operation
+ */
+typedef SiLVI_status(*SiLVI_COM_registerCyclicTx_p)(int32_t, const uint8_t*, uint64_t, uint64_t, uint64_t, uint64_t*);
+
+/*
+ * @brief Update the payload of a cyclic frame
+ * The new payload is used for all transmissions at virtual times at or after the time T of the update, earlier
+ * transmissions use the old payload. A transmission uses either the complete old or the complete new payload.
+ * For handles bound to a participant (see SiLVI_SYNC_bindHandle_p in SiLVI_SYNC.h) T is the current time of the
+ * participant plus its lookahead at the call, the same time a frame passed to SiLVI_COM_txFrame_p at the call would
+ * be sent at, so the switch is reproducible. For handles not bound to a participant T is the simulation time at the
+ * call, which depends on the timing of the host. The length of the frame is set to the size of the new payload, it must be a valid length
+ * for the bus type (e.g. one of the CAN FD lengths), otherwise SiLVI_ERROR_INVALID_FRAME is returned.
+ * @param [in] handle returned by the init function
+ * @param [in] id of the cyclic frame returned by SiLVI_COM_registerCyclicTx_p
+ * @param [in] pointer to the new payload
+ * @param [in] size of the new payload in bytes
+ * @return status indicating success or failure of the operation
+ *         SiLVI_ERROR_INVALID_INDEX if there is no cyclic frame with this id
+ */
+typedef SiLVI_status(*SiLVI_COM_updateCyclicPayload_p)(int32_t, uint64_t, const uint8_t*, uint64_t);
+
+/*
+ * @brief Stop the cyclic transmission of a frame
+ * There is no transmission at or after the time T defined for SiLVI_COM_updateCyclicPayload_p.
+ * @param [in] handle returned by the init function
+ * @param [in] id of the cyclic frame returned by SiLVI_COM_registerCyclicTx_p
+ * @return status indicating success or failure of the operation
+ *         SiLVI_ERROR_INVALID_INDEX if there is no cyclic frame with this id
+ */
+typedef SiLVI_status(*SiLVI_COM_unregisterCyclicTx_p)(int32_t, uint64_t);
+
+//bus types of the communication interface
+typedef enum SiLVI_COM_BusType
+{
+	SiLVI_COM_BUSTYPE_CAN = 1,
+	SiLVI_COM_BUSTYPE_LIN = 2,
+	SiLVI_COM_BUSTYPE_FLEXRAY = 3,
+	SiLVI_COM_BUSTYPE_ETHERNET = 4,
+	SiLVI_COM_BUSTYPE_CUSTOM_BUS = 5,
+	SiLVI_COM_BUSTYPE_CANXL = 6
+}
+SiLVI_COM_BusType;
+
+//one interface to be opened by SiLVI_COM_auto_initialize_many_p
+//The pointers are placed first, so the struct has no padding bytes inserted by the compiler on 32 bit and 64 bit
+//architectures
+typedef struct SiLVI_COM_Auto_Initialize_Request
+{
+	const char* logicalName;    //[in] logical name of the interface to open, e.g. "CAN:0"
+	void* parameters;           //[out] points to the parameters of the bus type in the arena, e.g. to a SiLVI_COM_CAN_Parameters
+	                            //for SiLVI_COM_BUSTYPE_CAN, NULL if no arena is provided
+	SiLVI_COM_BusType busType;  //[in] bus type of the interface, selects the auto_initialize function to be called
+	int32_t status;             //[out] SiLVI_status value of the auto initialization of this interface, int32_t because the
+	                            //size of the enum SiLVI_status depends on the compiler
+	int32_t handle;             //[out] the handle of the interface or INVALID_SiLVI_HANDLE if status is not SiLVI_OK
+	uint32_t padding;           //padding 32 bit word to avoid padding bytes inserted by the compiler
+}
+SiLVI_COM_Auto_Initialize_Request;
+
+/*
+ * @brief Auto initialization of multiple bus interfaces in one call
+ * Each request behaves like a call of the auto_initialize function of the respective bus type. The driver may
+ * open the interfaces in any order and in parallel and it may answer from a cache of auto configuration results,
+ * e.g. persisted and keyed by a hash of the simulation configuration, as long as the results are the same.
+ *
+ * All parameter structs including their dynamic content (VLAN IDs and multicast addresses of Ethernet interfaces,
+ * configuration data of custom bus interfaces) are written to one arena allocated by the caller. The arena must be
+ * aligned to 8 bytes, otherwise SiLVI_ERROR_INVALID_PARAMETERS is returned, so the required size does not depend on
+ * the address of the arena and does not change between two calls. The driver sets the pointers inside of the
+ * parameter structs to the respective locations in the arena and aligns all data to 8 bytes. If the arena is too small then no interface is opened, SiLVI_ERROR_ALLOCATED_MEMORY_TOO_SMALL is
+ * returned and the size of the arena is set to the required size. In that case the status of every request is set
+ * to SiLVI_ERROR_ALLOCATED_MEMORY_TOO_SMALL, its handle to INVALID_SiLVI_HANDLE and its parameters to NULL.
+ * The caller shall enlarge the arena and try again, so the configuration of all interfaces is returned in at most
+ * two calls.
+ * If the arena pointer is NULL and its size is 0 then no configuration data will be written by the driver.
+ *
+ * Example - open two interfaces, arena size guessed and enlarged if necessary
+ * SiLVI_COM_Auto_Initialize_Request requests[2];
+ * uint64_t arena_size = 4096;
+ * uint8_t* arena = (uint8_t*)malloc(arena_size);
+ * requests[0].logicalName = "CAN:0";
+ * requests[0].busType = SiLVI_COM_BUSTYPE_CAN;
+ * requests[1].logicalName = "ETHERNET:0";
+ * requests[1].busType = SiLVI_COM_BUSTYPE_ETHERNET;
+ * result = ptr->auto_initializeMany(requests, 2, arena, &arena_size);
+ * if (result == SiLVI_ERROR_ALLOCATED_MEMORY_TOO_SMALL) {
+ *     arena = (uint8_t*)realloc(arena, arena_size);
+ *     result = ptr->auto_initializeMany(requests, 2, arena, &arena_size);
+ * }
+ * if (result == SiLVI_OK) {
+ *     SiLVI_COM_Ethernet_Parameters* ethernet_params = (SiLVI_COM_Ethernet_Parameters*)requests[1].parameters;
+ * }
+ *
+ * The arena must be kept by the caller as long as it uses the returned parameters.
+ * Interfaces that have been opened successfully must be closed by calling SiLVI_COM_terminate_p(), even if
+ * other requests failed.
+ *
+ * @param [in,out] pointer to the array of requests
+ * @param [in] number of requests
+ * @param [in,out] pointer to the arena for the parameters, can be NULL if no configuration data is needed
+ * @param [in,out] pointer to the size of the arena, replaced by the required size if the arena is too small
+ * @return status indicating success or failure of the operation
+ *         SiLVI_OK if all interfaces have been opened
+ *         SiLVI_ERROR_ALLOCATED_MEMORY_TOO_SMALL if the arena is too small, no interface has been opened
+ *         otherwise the status of the failed request with the lowest index in the array of requests
+ */
+typedef SiLVI_status(*SiLVI_COM_auto_initialize_many_p)(SiLVI_COM_Auto_Initialize_Request*, uint64_t, uint8_t*, uint64_t*);
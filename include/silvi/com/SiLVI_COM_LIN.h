@@ -1,7 +1,7 @@
 /******************************************************************
 * FILE:            SiLVI_COM_LIN.h
-* VERSION:         3.0.0.0
-* DATE:            07.03.2024
+* VERSION:         3.1.1.0
+* DATE:            18.10.2026
 * DESCRIPTION:     Interface Description File
 * COPYRIGHT:       (C) 2024 VDA SiLVI Workgroup
 *
@@ -18,8 +18,13 @@ SiLVI API and ABI description
 * Version history:
 * MAJOR_ABI.MINOR_ABI.API.COMMENT version
 * 3.0.0.0	Introduced separate file for LIN
+*
+* 3.1.1.0	FlatBuffers file identifier of the frame buffers
 */
 
+//file identifier of the size prefixed frame buffers (NetworkModels.LIN.RegisterFile in network_model_lin.fbs)
+#define SiLVI_COM_LIN_FILE_IDENTIFIER "NML2"
+
 //LIN parameters
 typedef struct SiLVI_COM_LIN_Parameters
 {